@@ -2,8 +2,9 @@
 #include <iostream>
 #include <vector>
 #include <queue>
-#include <unordered_map>
-#include <unordered_set>
+#include <map>
+#include <memory>
+#include <limits>
 #include <cmath>
 #include <algorithm>
 #include <chrono>
@@ -11,7 +12,17 @@
 #include <functional>
 #include <numeric>
 #include <iomanip>
-#include <sstream>
+#include <memory_resource>
+#include <charconv>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <filesystem>
+#include <thread>
+#include <atomic>
 
 // Game Constants
 const int GRID_SIZE = 30;
@@ -20,6 +31,12 @@ const int WINDOW_WIDTH = GRID_SIZE * CELL_SIZE;
 const int WINDOW_HEIGHT = GRID_SIZE * CELL_SIZE;
 const float GAME_SPEED = 0.1f; // Seconds per move
 const int TOTAL_TURNS = 10;    // Total number of turns for competition
+const int ANYTIME_BUDGET_US = 200;       // Per-tick search time for anytime planners
+// Per-turn arena bytes: the food candidate list plus two worst-case paths, each up
+// to one Position (two ints) per cell and about twice that while their vectors grow
+const size_t TURN_ARENA_SIZE = 6 * GRID_SIZE * GRID_SIZE * sizeof(int) * 2;
+const int EXPORT_CELL_SIZE = 10;         // Cell size in pixels for exported frames
+const int MAX_HEADLESS_TICKS = 100000;  // Safety stop for headless runs
 
 // Position class to represent grid coordinates
 struct Position {
@@ -36,50 +53,988 @@ struct Position {
     }
 };
 
-// Custom hash function for Position to use in unordered_map
-namespace std {
-    template <>
-    struct hash<Position> {
-        size_t operator()(const Position& pos) const {
-            return hash<int>()(pos.x) ^ (hash<int>()(pos.y) << 1);
+// Direction enum for snake movement
+enum Direction {
+    UP, RIGHT, DOWN, LEFT
+};
+
+// Node structure for pathfinding algorithms
+struct Node {
+    Position pos;
+    float g_cost;    // Cost from start to this node
+    float h_cost;    // Heuristic cost to goal
+    float f_cost;    // g_cost + h_cost
+    Position parent;
+
+    Node(Position pos, float g = 0, float h = 0) :
+        pos(pos), g_cost(g), h_cost(h), f_cost(g + h) {
+    }
+
+    // Comparison operator for priority queue
+    bool operator>(const Node& other) const {
+        return f_cost > other.f_cost ||
+            (f_cost == other.f_cost && h_cost > other.h_cost);
+    }
+};
+
+// Performance metrics structure for each turn
+struct TurnMetrics {
+    int nodesExplored;
+    float computationTime;
+    float suboptimality;  // Steps walked over the Manhattan lower bound (1 = optimal)
+    size_t heapAllocations;  // Heap allocations made while planning and moving
+
+    TurnMetrics(int nodes = 0, float time = 0, float subopt = 1, size_t allocations = 0) :
+        nodesExplored(nodes), computationTime(time), suboptimality(subopt),
+        heapAllocations(allocations) {
+    }
+};
+
+// Fixed-capacity character buffer for HUD text, formatted without heap allocations
+struct TextBuffer {
+    char data[256];
+    size_t length;
+
+    TextBuffer() : length(0) {
+        data[0] = '\0';
+    }
+
+    void clear() {
+        length = 0;
+        data[0] = '\0';
+    }
+
+    void append(const char* str) {
+        while (*str && length + 1 < sizeof(data)) {
+            data[length++] = *str++;
+        }
+        data[length] = '\0';
+    }
+
+    void appendInt(long long value) {
+        auto result = std::to_chars(data + length, data + sizeof(data) - 1, value);
+        if (result.ec == std::errc()) length = result.ptr - data;
+        data[length] = '\0';
+    }
+
+    // Append a floating point number with specified precision
+    void appendFloat(float value, int precision = 2) {
+        auto result = std::to_chars(data + length, data + sizeof(data) - 1, value,
+            std::chars_format::fixed, precision);
+        if (result.ec == std::errc()) length = result.ptr - data;
+        data[length] = '\0';
+    }
+
+    bool operator==(const TextBuffer& other) const {
+        return length == other.length && std::memcmp(data, other.data, length) == 0;
+    }
+};
+
+// HUD text element; its glyph geometry is only rebuilt when the string changes
+struct HudText {
+    sf::Text text;
+    TextBuffer shown;
+
+    void update(const TextBuffer& next) {
+        if (next == shown) return;
+        shown = next;
+        text.setString(shown.data);
+    }
+};
+
+// Every heap allocation in the program, counted by the replaced operator new below
+std::atomic<size_t> heapAllocationCount(0);
+
+void* operator new(std::size_t size) {
+    heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// Calculate Manhattan distance between two positions
+float manhattanDistance(const Position& a, const Position& b) {
+    return std::abs(a.x - b.x) + std::abs(a.y - b.y);
+}
+
+// Check bounds; snake bodies are ignored for pathfinding
+bool inBounds(int x, int y) {
+    return x >= 0 && x < GRID_SIZE && y >= 0 && y < GRID_SIZE;
+}
+
+// Index of a position in the planners' flat per-cell arrays
+int cellIndex(const Position& pos) {
+    return pos.y * GRID_SIZE + pos.x;
+}
+
+Position cellPosition(int cell) {
+    return Position(cell % GRID_SIZE, cell / GRID_SIZE);
+}
+
+// Get valid neighbors for a position, returning how many were written to out
+int getNeighbors(const Position& pos, Position out[4]) {
+    static const Position directions[] = {
+        {0, -1}, {1, 0}, {0, 1}, {-1, 0}  // UP, RIGHT, DOWN, LEFT
+    };
+
+    int count = 0;
+    for (const auto& dir : directions) {
+        Position newPos(pos.x + dir.x, pos.y + dir.y);
+        if (inBounds(newPos.x, newPos.y)) {
+            out[count++] = newPos;
+        }
+    }
+    return count;
+}
+
+// Per-cell search state kept by a planner between calls. Cells are stamped with
+// the generation of the search that wrote them, so nothing is cleared per search.
+struct SearchWorkspace {
+    std::vector<float> gScore;
+    std::vector<Position> cameFrom;
+    std::vector<unsigned> seenStamp;    // Generation in which gScore/cameFrom were set
+    std::vector<unsigned> closedStamp;  // Generation in which the cell was closed
+    std::vector<unsigned> touchedStamp; // Generation in which the cell was first looked at
+    std::vector<Node> open;             // Binary heap ordered by std::greater<Node>
+    unsigned generation;
+
+    SearchWorkspace() :
+        gScore(GRID_SIZE * GRID_SIZE), cameFrom(GRID_SIZE * GRID_SIZE),
+        seenStamp(GRID_SIZE * GRID_SIZE, 0), closedStamp(GRID_SIZE * GRID_SIZE, 0),
+        touchedStamp(GRID_SIZE * GRID_SIZE, 0), generation(0) {
+        open.reserve(GRID_SIZE * GRID_SIZE * 4);
+    }
+
+    // Start a new search
+    void begin() {
+        open.clear();
+        if (++generation == 0) {
+            std::fill(seenStamp.begin(), seenStamp.end(), 0);
+            std::fill(closedStamp.begin(), closedStamp.end(), 0);
+            std::fill(touchedStamp.begin(), touchedStamp.end(), 0);
+            generation = 1;
+        }
+    }
+
+    bool seen(int cell) const { return seenStamp[cell] == generation; }
+    bool closed(int cell) const { return closedStamp[cell] == generation; }
+    void close(int cell) { closedStamp[cell] = generation; }
+
+    // Mark a cell as looked at; true the first time in this search
+    bool touch(int cell) {
+        if (touchedStamp[cell] == generation) return false;
+        touchedStamp[cell] = generation;
+        return true;
+    }
+
+    void record(int cell, float g, const Position& parent) {
+        gScore[cell] = g;
+        cameFrom[cell] = parent;
+        seenStamp[cell] = generation;
+    }
+
+    void pushOpen(const Node& node) {
+        open.push_back(node);
+        std::push_heap(open.begin(), open.end(), std::greater<Node>());
+    }
+
+    Node popOpen() {
+        std::pop_heap(open.begin(), open.end(), std::greater<Node>());
+        Node node = open.back();
+        open.pop_back();
+        return node;
+    }
+
+    // Reconstruct path from start (exclusive) to goal (inclusive) along cameFrom
+    void reconstruct(const Position& start, const Position& goal, std::pmr::vector<Position>& path) const {
+        Position currentPos = goal;
+        while (currentPos != start) {
+            path.push_back(currentPos);
+            currentPos = cameFrom[cellIndex(currentPos)];
+        }
+        std::reverse(path.begin(), path.end());
+    }
+};
+
+// Pathfinding algorithm driving a snake. Planners keep their workspace between
+// calls, so each snake gets its own instance.
+class PathPlanner {
+public:
+    virtual ~PathPlanner() {}
+
+    // Name shown on the HUD
+    virtual const char* label() const = 0;
+
+    // Fill path with the cells after start up to and including goal, or leave it
+    // empty if there is no path. Returns the number of nodes explored.
+    virtual int findPath(const Position& start, const Position& goal, std::pmr::vector<Position>& path) = 0;
+
+    // Bound on the cost of the last path relative to optimal (1 = optimal), for the
+    // start the search was asked about
+    virtual float suboptimality() const { return 1.0f; }
+
+    // Anytime planners: true while the last search can still improve its path
+    virtual bool improving() const { return false; }
+
+    // Anytime planners: continue the last search. If a better path is found, replace
+    // path with the route from `from`, a cell on the previous path, and return true.
+    virtual bool improvePath(const Position& /*from*/, std::pmr::vector<Position>& /*path*/,
+        int& /*nodesExplored*/) {
+        return false;
+    }
+};
+
+// Best-first search ordered by gWeight * g + hWeight * h, where h is the Manhattan
+// distance: Dijkstra (1, 0), A* (1, 1), weighted A* (1, w) and greedy best-first (0, 1)
+class BestFirstPlanner : public PathPlanner {
+public:
+    BestFirstPlanner(const char* name, float gWeight, float hWeight) :
+        name(name), gWeight(gWeight), hWeight(hWeight) {
+    }
+
+    const char* label() const override { return name; }
+
+    // Weighted A* is bounded by the heuristic weight; greedy search has no bound
+    float suboptimality() const override {
+        if (gWeight <= 0) return std::numeric_limits<float>::infinity();
+        return std::max(1.0f, hWeight / gWeight);
+    }
+
+    int findPath(const Position& start, const Position& goal, std::pmr::vector<Position>& path) override {
+        path.clear();
+        workspace.begin();
+        workspace.record(cellIndex(start), 0, start);
+        workspace.pushOpen(makeNode(start, 0, goal));
+
+        int nodesExplored = 0;
+        Position neighbors[4];
+
+        while (!workspace.open.empty()) {
+            Node current = workspace.popOpen();
+            int currentCell = cellIndex(current.pos);
+
+            // Skip queue entries superseded by a cheaper path
+            if (workspace.closed(currentCell)) {
+                continue;
+            }
+            nodesExplored++;
+
+            if (current.pos == goal) {
+                workspace.reconstruct(start, goal, path);
+                return nodesExplored;
+            }
+
+            workspace.close(currentCell);
+            float currentG = workspace.gScore[currentCell];
+
+            int count = getNeighbors(current.pos, neighbors);
+            for (int i = 0; i < count; i++) {
+                int cell = cellIndex(neighbors[i]);
+                if (workspace.closed(cell)) {
+                    continue;
+                }
+
+                float tentative_gScore = currentG + 1;
+
+                if (!workspace.seen(cell) || tentative_gScore < workspace.gScore[cell]) {
+                    workspace.record(cell, tentative_gScore, current.pos);
+                    workspace.pushOpen(makeNode(neighbors[i], tentative_gScore, goal));
+                }
+            }
+        }
+
+        // No path found
+        return nodesExplored;
+    }
+
+private:
+    const char* name;
+    float gWeight;
+    float hWeight;
+    SearchWorkspace workspace;
+
+    // Queue entries carry the weighted costs; true g values live in the workspace
+    Node makeNode(const Position& pos, float g, const Position& goal) const {
+        return Node(pos, gWeight * g, hWeight * manhattanDistance(pos, goal));
+    }
+};
+
+// Breadth-first search; optimal here since every move costs the same
+class BreadthFirstPlanner : public PathPlanner {
+public:
+    BreadthFirstPlanner() {
+        frontier.reserve(GRID_SIZE * GRID_SIZE);
+    }
+
+    const char* label() const override { return "BFS"; }
+
+    int findPath(const Position& start, const Position& goal, std::pmr::vector<Position>& path) override {
+        path.clear();
+        workspace.begin();
+        frontier.clear();
+
+        workspace.record(cellIndex(start), 0, start);
+        frontier.push_back(start);
+
+        int nodesExplored = 0;
+        Position neighbors[4];
+
+        for (size_t head = 0; head < frontier.size(); head++) {
+            Position current = frontier[head];
+            nodesExplored++;
+
+            if (current == goal) {
+                workspace.reconstruct(start, goal, path);
+                return nodesExplored;
+            }
+
+            float currentG = workspace.gScore[cellIndex(current)];
+            int count = getNeighbors(current, neighbors);
+            for (int i = 0; i < count; i++) {
+                int cell = cellIndex(neighbors[i]);
+                if (!workspace.seen(cell)) {
+                    workspace.record(cell, currentG + 1, current);
+                    frontier.push_back(neighbors[i]);
+                }
+            }
+        }
+
+        // No path found
+        return nodesExplored;
+    }
+
+private:
+    SearchWorkspace workspace;
+    std::vector<Position> frontier;  // FIFO queue, consumed by index
+};
+
+// Iterative deepening A*: depth-first search bounded by f, raising the bound to
+// the smallest f that exceeded it until the goal is reached
+class IDAStarPlanner : public PathPlanner {
+public:
+    IDAStarPlanner() : onPath(GRID_SIZE * GRID_SIZE, 0), nodesExplored(0) {
+        stack.reserve(GRID_SIZE * GRID_SIZE);
+    }
+
+    const char* label() const override { return "IDA*"; }
+
+    int findPath(const Position& start, const Position& goal, std::pmr::vector<Position>& path) override {
+        path.clear();
+        stack.clear();
+        stack.push_back(start);
+        onPath[cellIndex(start)] = 1;
+        nodesExplored = 0;
+
+        float threshold = manhattanDistance(start, goal);
+        while (true) {
+            float next = search(0, threshold, goal);
+            if (next == FOUND) {
+                path.assign(stack.begin() + 1, stack.end());
+                break;
+            }
+            // No path can be longer than the number of cells
+            if (next > GRID_SIZE * GRID_SIZE) {
+                break;
+            }
+            threshold = next;
+        }
+
+        for (const auto& pos : stack) {
+            onPath[cellIndex(pos)] = 0;
+        }
+        return nodesExplored;
+    }
+
+private:
+    static constexpr float FOUND = -1.0f;
+
+    std::vector<Position> stack;  // Current depth-first path, start first
+    std::vector<char> onPath;     // Cells on stack, to avoid cycles
+    int nodesExplored;
+
+    // Returns FOUND, or the smallest f above threshold seen below the top of the stack
+    float search(float g, float threshold, const Position& goal) {
+        Position current = stack.back();
+        float f = g + manhattanDistance(current, goal);
+        if (f > threshold) {
+            return f;
+        }
+        nodesExplored++;
+
+        if (current == goal) {
+            return FOUND;
+        }
+
+        float minimum = std::numeric_limits<float>::infinity();
+        Position neighbors[4];
+        int count = getNeighbors(current, neighbors);
+        for (int i = 0; i < count; i++) {
+            int cell = cellIndex(neighbors[i]);
+            if (onPath[cell]) {
+                continue;
+            }
+
+            stack.push_back(neighbors[i]);
+            onPath[cell] = 1;
+            float result = search(g + 1, threshold, goal);
+            if (result == FOUND) {
+                return FOUND;
+            }
+            stack.pop_back();
+            onPath[cell] = 0;
+            minimum = std::min(minimum, result);
+        }
+        return minimum;
+    }
+};
+
+// Fringe search: IDA*-style f thresholds over a single linked list of frontier
+// nodes, with g values and parents cached so iterations do not start over
+class FringePlanner : public PathPlanner {
+public:
+    FringePlanner() :
+        next(GRID_SIZE * GRID_SIZE + 1), prev(GRID_SIZE * GRID_SIZE + 1),
+        inFringe(GRID_SIZE * GRID_SIZE, 0) {
+    }
+
+    const char* label() const override { return "Fringe"; }
+
+    int findPath(const Position& start, const Position& goal, std::pmr::vector<Position>& path) override {
+        path.clear();
+        workspace.begin();
+        next[HEAD] = prev[HEAD] = HEAD;
+
+        int startCell = cellIndex(start);
+        workspace.record(startCell, 0, start);
+        insertAfter(HEAD, startCell);
+
+        float fLimit = manhattanDistance(start, goal);
+        int nodesExplored = 0;
+        Position neighbors[4];
+
+        while (next[HEAD] != HEAD) {
+            float fMin = std::numeric_limits<float>::infinity();
+            int cell = next[HEAD];
+
+            while (cell != HEAD) {
+                Position current = cellPosition(cell);
+                float g = workspace.gScore[cell];
+                float f = g + manhattanDistance(current, goal);
+
+                // Defer to a later iteration
+                if (f > fLimit) {
+                    fMin = std::min(fMin, f);
+                    cell = next[cell];
+                    continue;
+                }
+                nodesExplored++;
+
+                if (current == goal) {
+                    clearFringe();
+                    workspace.reconstruct(start, goal, path);
+                    return nodesExplored;
+                }
+
+                // Insert children right after the current node, so they are visited
+                // in this iteration, in neighbor order
+                int count = getNeighbors(current, neighbors);
+                for (int i = count - 1; i >= 0; i--) {
+                    int child = cellIndex(neighbors[i]);
+                    if (workspace.seen(child) && g + 1 >= workspace.gScore[child]) {
+                        continue;
+                    }
+                    if (inFringe[child]) {
+                        remove(child);
+                    }
+                    insertAfter(cell, child);
+                    workspace.record(child, g + 1, current);
+                }
+
+                int following = next[cell];
+                remove(cell);
+                cell = following;
+            }
+
+            fLimit = fMin;
+        }
+
+        // No path found
+        return nodesExplored;
+    }
+
+private:
+    static const int HEAD = GRID_SIZE * GRID_SIZE;  // List sentinel
+
+    SearchWorkspace workspace;
+    std::vector<int> next;
+    std::vector<int> prev;
+    std::vector<char> inFringe;
+
+    void insertAfter(int at, int cell) {
+        next[cell] = next[at];
+        prev[cell] = at;
+        prev[next[at]] = cell;
+        next[at] = cell;
+        inFringe[cell] = 1;
+    }
+
+    void remove(int cell) {
+        next[prev[cell]] = next[cell];
+        prev[next[cell]] = prev[cell];
+        inFringe[cell] = 0;
+    }
+
+    void clearFringe() {
+        for (int cell = next[HEAD]; cell != HEAD; cell = next[cell]) {
+            inFringe[cell] = 0;
+        }
+        next[HEAD] = prev[HEAD] = HEAD;
+    }
+};
+
+// Jump point search for 4-connected grids. Canonical paths move vertically and
+// turn horizontally, so horizontal jumps only stop at the goal or where a blocked
+// cell beside the previous step forces a vertical turn, and vertical jumps stop
+// wherever a horizontal jump would find something.
+class JumpPointPlanner : public PathPlanner {
+public:
+    const char* label() const override { return "JPS"; }
+
+    int findPath(const Position& start, const Position& goal, std::pmr::vector<Position>& path) override {
+        path.clear();
+        workspace.begin();
+        this->goal = goal;
+        cellsTouched = 0;
+        touch(start.x, start.y);
+
+        workspace.record(cellIndex(start), 0, start);
+        workspace.pushOpen(Node(start, 0, manhattanDistance(start, goal)));
+
+        while (!workspace.open.empty()) {
+            Node current = workspace.popOpen();
+            int currentCell = cellIndex(current.pos);
+
+            if (workspace.closed(currentCell)) {
+                continue;
+            }
+
+            if (current.pos == goal) {
+                reconstruct(start, path);
+                return cellsTouched;
+            }
+
+            workspace.close(currentCell);
+            float currentG = workspace.gScore[currentCell];
+            Position parent = workspace.cameFrom[currentCell];
+
+            Position directions[4];
+            int count = successorDirections(current.pos, parent, start, directions);
+            for (int i = 0; i < count; i++) {
+                Position jumpPoint;
+                if (!jump(current.pos, directions[i], jumpPoint)) {
+                    continue;
+                }
+
+                int cell = cellIndex(jumpPoint);
+                if (workspace.closed(cell)) {
+                    continue;
+                }
+
+                float tentative_gScore = currentG + manhattanDistance(current.pos, jumpPoint);
+                if (!workspace.seen(cell) || tentative_gScore < workspace.gScore[cell]) {
+                    workspace.record(cell, tentative_gScore, current.pos);
+                    workspace.pushOpen(Node(jumpPoint, tentative_gScore, manhattanDistance(jumpPoint, goal)));
+                }
+            }
+        }
+
+        // No path found
+        return cellsTouched;
+    }
+
+private:
+    SearchWorkspace workspace;
+    Position goal;
+    // Distinct cells the current search has looked at. Jumps re-scan the same rows
+    // and columns, so this is counted once per cell to stay comparable with the
+    // other planners' expansions; expanded jump points are among these cells.
+    int cellsTouched;
+
+    void touch(int x, int y) {
+        if (workspace.touch(cellIndex(Position(x, y)))) cellsTouched++;
+    }
+
+    // A horizontal step in dx forces a vertical turn towards dy when the cell beside
+    // the previous step was blocked but the one beside this step is not
+    bool forced(int x, int y, int dx, int dy) const {
+        return inBounds(x, y + dy) && !inBounds(x - dx, y + dy);
+    }
+
+    bool jumpHorizontal(int x, int y, int dx, Position& out) {
+        while (true) {
+            x += dx;
+            if (!inBounds(x, y)) return false;
+            touch(x, y);
+            if ((x == goal.x && y == goal.y) || forced(x, y, dx, -1) || forced(x, y, dx, 1)) {
+                out = Position(x, y);
+                return true;
+            }
+        }
+    }
+
+    bool jumpVertical(int x, int y, int dy, Position& out) {
+        Position unused;
+        while (true) {
+            y += dy;
+            if (!inBounds(x, y)) return false;
+            touch(x, y);
+            if ((x == goal.x && y == goal.y) ||
+                jumpHorizontal(x, y, 1, unused) || jumpHorizontal(x, y, -1, unused)) {
+                out = Position(x, y);
+                return true;
+            }
+        }
+    }
+
+    bool jump(const Position& from, const Position& dir, Position& out) {
+        if (dir.x != 0) return jumpHorizontal(from.x, from.y, dir.x, out);
+        return jumpVertical(from.x, from.y, dir.y, out);
+    }
+
+    // Directions to jump in from pos, given the jump point it was reached from
+    int successorDirections(const Position& pos, const Position& parent, const Position& start,
+        Position out[4]) const {
+        int count = 0;
+        if (pos == start) {
+            out[count++] = Position(0, -1);
+            out[count++] = Position(1, 0);
+            out[count++] = Position(0, 1);
+            out[count++] = Position(-1, 0);
+            return count;
+        }
+
+        int dx = (pos.x > parent.x) - (pos.x < parent.x);
+        int dy = (pos.y > parent.y) - (pos.y < parent.y);
+        if (dx != 0) {
+            out[count++] = Position(dx, 0);
+            if (forced(pos.x, pos.y, dx, -1)) out[count++] = Position(0, -1);
+            if (forced(pos.x, pos.y, dx, 1)) out[count++] = Position(0, 1);
+        }
+        else {
+            out[count++] = Position(0, dy);
+            out[count++] = Position(1, 0);
+            out[count++] = Position(-1, 0);
+        }
+        return count;
+    }
+
+    // Expand the straight segments between jump points into individual cells
+    void reconstruct(const Position& start, std::pmr::vector<Position>& path) const {
+        Position jumpPoint = goal;
+        while (jumpPoint != start) {
+            Position parent = workspace.cameFrom[cellIndex(jumpPoint)];
+            int dx = (parent.x > jumpPoint.x) - (parent.x < jumpPoint.x);
+            int dy = (parent.y > jumpPoint.y) - (parent.y < jumpPoint.y);
+            for (Position pos = jumpPoint; pos != parent; pos = Position(pos.x + dx, pos.y + dy)) {
+                path.push_back(pos);
+            }
+            jumpPoint = parent;
+        }
+        std::reverse(path.begin(), path.end());
+    }
+};
+
+// Anytime repairing A* (ARA*): weighted A* whose weight is lowered after each
+// solution, reusing earlier search effort, until the path is optimal. Each call
+// runs for at most budgetMicroseconds and improvePath resumes where it stopped.
+// The search is rooted at the goal, so cameFrom leads every reached cell to the
+// goal and improved paths can be handed out from wherever the snake has moved to.
+class AnytimeAStarPlanner : public PathPlanner {
+public:
+    AnytimeAStarPlanner(int budgetMicroseconds, float initialEpsilon, float epsilonStep) :
+        budget(budgetMicroseconds), initialEpsilon(initialEpsilon), epsilonStep(epsilonStep),
+        epsilon(initialEpsilon), bound(1.0f), active(false), iteration(0),
+        closedStamp(GRID_SIZE * GRID_SIZE, 0), inconsStamp(GRID_SIZE * GRID_SIZE, 0),
+        rebuiltStamp(GRID_SIZE * GRID_SIZE, 0) {
+        incons.reserve(GRID_SIZE * GRID_SIZE);
+        rebuild.reserve(GRID_SIZE * GRID_SIZE * 4);
+    }
+
+    const char* label() const override { return "ARA*"; }
+    float suboptimality() const override { return bound; }
+    bool improving() const override { return active; }
+
+    int findPath(const Position& start, const Position& goal, std::pmr::vector<Position>& path) override {
+        path.clear();
+        workspace.begin();
+        nextIteration();
+
+        root = goal;
+        target = start;
+        epsilon = initialEpsilon;
+        bound = std::numeric_limits<float>::infinity();
+        active = true;
+
+        workspace.record(cellIndex(root), 0, root);
+        workspace.pushOpen(makeNode(root, 0));
+
+        int nodesExplored = 0;
+        if (search(nodesExplored)) {
+            fillPath(start, path);
+        }
+        return nodesExplored;
+    }
+
+    bool improvePath(const Position& from, std::pmr::vector<Position>& path, int& nodesExplored) override {
+        if (!active || !search(nodesExplored)) {
+            return false;
+        }
+        path.clear();
+        fillPath(from, path);
+        return true;
+    }
+
+private:
+    static const int CLOCK_CHECK_INTERVAL = 32;  // Expansions between deadline checks
+
+    int budget;
+    float initialEpsilon;
+    float epsilonStep;
+    float epsilon;
+    float bound;      // Suboptimality bound of the last published path
+    bool active;      // Search can still improve its path
+    Position root;    // Goal of the request; the search starts here
+    Position target;  // Start of the request
+    unsigned iteration;
+
+    SearchWorkspace workspace;
+    std::vector<unsigned> closedStamp;   // Iteration in which the cell was closed
+    std::vector<unsigned> inconsStamp;   // Iteration in which the cell was added to incons
+    std::vector<unsigned> rebuiltStamp;  // Iteration in which the cell was re-queued
+    std::vector<Position> incons;        // Closed cells whose g improved this iteration
+    std::vector<Position> rebuild;       // Cells to re-queue with the next epsilon
+
+    Node makeNode(const Position& pos, float g) const {
+        return Node(pos, g, epsilon * manhattanDistance(pos, target));
+    }
+
+    bool stale(const Node& node) const {
+        int cell = cellIndex(node.pos);
+        return closedStamp[cell] == iteration || node.g_cost > workspace.gScore[cell];
+    }
+
+    void nextIteration() {
+        incons.clear();
+        if (++iteration == 0) {
+            std::fill(closedStamp.begin(), closedStamp.end(), 0);
+            std::fill(inconsStamp.begin(), inconsStamp.end(), 0);
+            std::fill(rebuiltStamp.begin(), rebuiltStamp.end(), 0);
+            iteration = 1;
+        }
+    }
+
+    // Search until the time budget runs out or the path is optimal. Returns true
+    // if at least one path was published during this call.
+    bool search(int& nodesExplored) {
+        auto deadline = std::chrono::high_resolution_clock::now() + std::chrono::microseconds(budget);
+        bool published = false;
+
+        while (active) {
+            if (!improve(deadline, nodesExplored)) {
+                break;  // Out of time; resume on the next call
+            }
+
+            int targetCell = cellIndex(target);
+            if (!workspace.seen(targetCell)) {
+                active = false;  // No path found
+                break;
+            }
+
+            bound = std::max(1.0f, std::min(epsilon, workspace.gScore[targetCell] / lowerBound()));
+            published = true;
+
+            if (bound <= 1.0f) {
+                active = false;
+                break;
+            }
+
+            epsilon = std::max(1.0f, epsilon - epsilonStep);
+            requeue();
+        }
+
+        return published;
+    }
+
+    // ImprovePath from ARA*: expand until no open cell has a smaller key than the target.
+    // Returns false if the deadline passed first.
+    bool improve(std::chrono::high_resolution_clock::time_point deadline, int& nodesExplored) {
+        int targetCell = cellIndex(target);
+        int sinceClockCheck = 0;
+        Position neighbors[4];
+
+        while (!workspace.open.empty()) {
+            if (stale(workspace.open.front())) {
+                workspace.popOpen();
+                continue;
+            }
+
+            if (workspace.seen(targetCell) && workspace.gScore[targetCell] <= workspace.open.front().f_cost) {
+                return true;
+            }
+
+            if (++sinceClockCheck == CLOCK_CHECK_INTERVAL) {
+                sinceClockCheck = 0;
+                if (std::chrono::high_resolution_clock::now() >= deadline) {
+                    return false;
+                }
+            }
+
+            Node current = workspace.popOpen();
+            int currentCell = cellIndex(current.pos);
+            closedStamp[currentCell] = iteration;
+            nodesExplored++;
+
+            float currentG = workspace.gScore[currentCell];
+            int count = getNeighbors(current.pos, neighbors);
+            for (int i = 0; i < count; i++) {
+                int cell = cellIndex(neighbors[i]);
+                float tentative_gScore = currentG + 1;
+
+                if (workspace.seen(cell) && tentative_gScore >= workspace.gScore[cell]) {
+                    continue;
+                }
+
+                workspace.record(cell, tentative_gScore, current.pos);
+                if (closedStamp[cell] != iteration) {
+                    workspace.pushOpen(makeNode(neighbors[i], tentative_gScore));
+                }
+                else if (inconsStamp[cell] != iteration) {
+                    inconsStamp[cell] = iteration;
+                    incons.push_back(neighbors[i]);
+                }
+            }
         }
-    };
-}
 
-// Direction enum for snake movement
-enum Direction {
-    UP, RIGHT, DOWN, LEFT
-};
+        return true;
+    }
 
-// Node structure for pathfinding algorithms
-struct Node {
-    Position pos;
-    float g_cost;    // Cost from start to this node
-    float h_cost;    // Heuristic cost to goal
-    float f_cost;    // g_cost + h_cost
-    Position parent;
+    // Smallest unweighted f over open and incons, a lower bound on the optimal cost
+    float lowerBound() const {
+        float best = std::numeric_limits<float>::infinity();
+        for (const auto& node : workspace.open) {
+            if (!stale(node)) {
+                best = std::min(best, node.g_cost + manhattanDistance(node.pos, target));
+            }
+        }
+        for (const auto& pos : incons) {
+            best = std::min(best, workspace.gScore[cellIndex(pos)] + manhattanDistance(pos, target));
+        }
+        return best;
+    }
 
-    Node(Position pos, float g = 0, float h = 0) :
-        pos(pos), g_cost(g), h_cost(h), f_cost(g + h) {
+    // Move incons into open, reopen closed cells and recompute keys for the new epsilon
+    void requeue() {
+        rebuild.clear();
+        for (const auto& node : workspace.open) {
+            if (!stale(node)) {
+                rebuild.push_back(node.pos);
+            }
+        }
+        rebuild.insert(rebuild.end(), incons.begin(), incons.end());
+
+        nextIteration();
+        workspace.open.clear();
+        for (const auto& pos : rebuild) {
+            int cell = cellIndex(pos);
+            if (rebuiltStamp[cell] != iteration) {
+                rebuiltStamp[cell] = iteration;
+                workspace.open.push_back(makeNode(pos, workspace.gScore[cell]));
+            }
+        }
+        std::make_heap(workspace.open.begin(), workspace.open.end(), std::greater<Node>());
     }
 
-    // Comparison operator for priority queue
-    bool operator>(const Node& other) const {
-        return f_cost > other.f_cost ||
-            (f_cost == other.f_cost && h_cost > other.h_cost);
+    // Follow cameFrom from a reached cell to the goal
+    void fillPath(const Position& from, std::pmr::vector<Position>& path) const {
+        if (!workspace.seen(cellIndex(from))) {
+            return;
+        }
+        Position currentPos = from;
+        while (currentPos != root) {
+            currentPos = workspace.cameFrom[cellIndex(currentPos)];
+            path.push_back(currentPos);
+        }
     }
 };
 
-// Performance metrics structure for each turn
-struct TurnMetrics {
-    int nodesExplored;
-    float computationTime;
+// Planners selectable by name on the command line
+class PlannerRegistry {
+public:
+    typedef std::function<std::unique_ptr<PathPlanner>()> Factory;
+
+    void add(const std::string& name, const std::string& description, Factory factory) {
+        entries[name] = Entry{ description, factory };
+    }
+
+    // Returns nullptr for an unknown name
+    std::unique_ptr<PathPlanner> create(const std::string& name) const {
+        auto it = entries.find(name);
+        if (it == entries.end()) return nullptr;
+        return it->second.factory();
+    }
 
-    TurnMetrics(int nodes = 0, float time = 0) :
-        nodesExplored(nodes), computationTime(time) {
+    void list(std::ostream& out) const {
+        for (const auto& entry : entries) {
+            out << "  " << std::left << std::setw(10) << entry.first << entry.second.description << "\n";
+        }
     }
+
+private:
+    struct Entry {
+        std::string description;
+        Factory factory;
+    };
+
+    std::map<std::string, Entry> entries;
 };
 
+void registerBuiltinPlanners(PlannerRegistry& registry) {
+    registry.add("astar", "A* with Manhattan heuristic", [] {
+        return std::unique_ptr<PathPlanner>(new BestFirstPlanner("A*", 1, 1));
+    });
+    registry.add("dijkstra", "Dijkstra's algorithm (no heuristic)", [] {
+        return std::unique_ptr<PathPlanner>(new BestFirstPlanner("Dijkstra", 1, 0));
+    });
+    registry.add("greedy", "Greedy best-first search (heuristic only)", [] {
+        return std::unique_ptr<PathPlanner>(new BestFirstPlanner("Greedy", 0, 1));
+    });
+    registry.add("wastar", "Weighted A* (heuristic weight 2)", [] {
+        return std::unique_ptr<PathPlanner>(new BestFirstPlanner("Weighted A*", 1, 2));
+    });
+    registry.add("arastar", "Anytime repairing A* (ARA*), time-budgeted per tick", [] {
+        return std::unique_ptr<PathPlanner>(new AnytimeAStarPlanner(ANYTIME_BUDGET_US, 3.0f, 0.5f));
+    });
+    registry.add("bfs", "Breadth-first search", [] {
+        return std::unique_ptr<PathPlanner>(new BreadthFirstPlanner());
+    });
+    registry.add("idastar", "Iterative deepening A*", [] {
+        return std::unique_ptr<PathPlanner>(new IDAStarPlanner());
+    });
+    registry.add("fringe", "Fringe search", [] {
+        return std::unique_ptr<PathPlanner>(new FringePlanner());
+    });
+    registry.add("jps", "Jump point search (4-connected)", [] {
+        return std::unique_ptr<PathPlanner>(new JumpPointPlanner());
+    });
+}
+
 // Snake class
 class Snake {
 public:
@@ -90,11 +1045,25 @@ public:
     int score;
     int nodesExplored;
     float computationTime;
+    float suboptimality;                    // Planner's bound for the path being followed
+    size_t heapAllocations;                 // Heap allocations made this turn
+    Position turnStart;                     // Head position when this turn started
+    int turnSteps;                          // Cells moved this turn
     std::vector<TurnMetrics> turnMetrics;  // Track metrics for each turn
+    long long totalNodesExplored;           // Running totals over turnMetrics
+    float totalComputationTime;
+    float totalSuboptimality;
+    size_t totalHeapAllocations;
 
     Snake(Position startPos, Direction dir, sf::Color col, std::string algo) :
         direction(dir), color(col), algorithm(algo), score(0),
-        nodesExplored(0), computationTime(0) {
+        nodesExplored(0), computationTime(0), suboptimality(1), heapAllocations(0),
+        turnStart(startPos), turnSteps(0),
+        totalNodesExplored(0), totalComputationTime(0), totalSuboptimality(0),
+        totalHeapAllocations(0) {
+        // A snake grows once per turn; reserve up front so turns never reallocate
+        body.reserve(TOTAL_TURNS + 1);
+        turnMetrics.reserve(TOTAL_TURNS);
         body.push_back(startPos);
     }
 
@@ -112,11 +1081,20 @@ public:
     void move(const Position& nextPos) {
         body.insert(body.begin(), nextPos);
         body.pop_back();
+        turnSteps++;
     }
 
     void grow(const Position& nextPos) {
         body.insert(body.begin(), nextPos);
         score++;
+        turnSteps++;
+    }
+
+    // Reset per-turn counters
+    void beginTurn() {
+        heapAllocations = 0;
+        turnStart = getHead();
+        turnSteps = 0;
     }
 
     bool selfCollision() const {
@@ -129,222 +1107,359 @@ public:
 
     // Store metrics for current turn
     void recordTurnMetrics() {
-        turnMetrics.push_back(TurnMetrics(nodesExplored, computationTime));
+        // Suboptimality of the route actually walked, which for anytime planners may
+        // mix several paths; Manhattan distance is a lower bound on its optimal length
+        float lowerBound = manhattanDistance(turnStart, getHead());
+        float walked = lowerBound > 0 ? turnSteps / lowerBound : 1.0f;
+
+        turnMetrics.push_back(TurnMetrics(nodesExplored, computationTime, walked, heapAllocations));
+        totalNodesExplored += nodesExplored;
+        totalComputationTime += computationTime;
+        totalSuboptimality += walked;
+        totalHeapAllocations += heapAllocations;
     }
 
-    // Calculate average metrics across turns
+    // Average metrics across turns, from the running totals
     TurnMetrics getAverageMetrics() const {
         if (turnMetrics.empty()) return TurnMetrics();
 
-        int totalNodes = 0;
-        float totalTime = 0.0f;
-
-        for (const auto& metrics : turnMetrics) {
-            totalNodes += metrics.nodesExplored;
-            totalTime += metrics.computationTime;
-        }
-
         return TurnMetrics(
-            totalNodes / turnMetrics.size(),
-            totalTime / turnMetrics.size()
+            static_cast<int>(totalNodesExplored / static_cast<long long>(turnMetrics.size())),
+            totalComputationTime / turnMetrics.size(),
+            totalSuboptimality / turnMetrics.size(),
+            totalHeapAllocations / turnMetrics.size()
         );
     }
 };
 
-// Game class
-class Game {
-private:
-    sf::RenderWindow window;
-    Snake snake1;
-    Snake snake2;
+// Everything needed to draw one tick of a run, independent of the Game and window
+struct FrameSnapshot {
+    std::vector<Position> snake1;
+    std::vector<Position> snake2;
+    std::vector<Position> path1;
+    std::vector<Position> path2;
     Position food;
-    sf::Font font;
-    sf::Text scoreText;
-    sf::Text statsText;
-    sf::Text turnText;
-    sf::Text avgMetricsText;
-    sf::Clock gameClock;
-    float elapsedTime;
-    bool gameOver;
-    std::mt19937 rng;
-    int currentTurn;
+};
 
-    // Get valid neighbors for a position
-    std::vector<Position> getNeighbors(const Position& pos) {
-        std::vector<Position> neighbors;
-        std::vector<Position> directions = {
-            {0, -1}, {1, 0}, {0, 1}, {-1, 0}  // UP, RIGHT, DOWN, LEFT
-        };
+// Palette for offline frames, matching the live window. Path tints are the window's
+// translucent path colors pre-blended over an empty cell.
+enum FrameColor {
+    FRAME_GRID, FRAME_CELL, FRAME_PATH1, FRAME_PATH2, FRAME_FOOD, FRAME_SNAKE1, FRAME_SNAKE2,
+    FRAME_COLOR_COUNT
+};
 
-        for (const auto& dir : directions) {
-            Position newPos(pos.x + dir.x, pos.y + dir.y);
+const unsigned char FRAME_PALETTE[FRAME_COLOR_COUNT][3] = {
+    {70, 70, 70},   // Grid lines
+    {30, 30, 30},   // Empty cell
+    {101, 52, 52},  // Snake 1 path
+    {52, 52, 101},  // Snake 2 path
+    {0, 255, 0},    // Food
+    {255, 0, 0},    // Snake 1
+    {0, 0, 255}     // Snake 2
+};
 
-            // Check bounds
-            if (newPos.x >= 0 && newPos.x < GRID_SIZE &&
-                newPos.y >= 0 && newPos.y < GRID_SIZE) {
-                neighbors.push_back(newPos);
-            }
-        }
+// Software rasterizer drawing a snapshot into an 8-bit palette image
+class FrameRasterizer {
+public:
+    const int cellSize;
+    const int width;
+    const int height;
 
-        return neighbors;
+    explicit FrameRasterizer(int cellSize) :
+        cellSize(cellSize), width(GRID_SIZE * cellSize), height(GRID_SIZE * cellSize),
+        pixels(width * height) {
     }
 
+    const unsigned char* data() const { return pixels.data(); }
 
-    // Modified to ignore snake body collisions for pathfinding, we only check bounds
-    bool isValid(const Position& pos, const Snake& currentSnake, const Snake& otherSnake) {
-        // Check bounds
-        if (pos.x < 0 || pos.x >= GRID_SIZE || pos.y < 0 || pos.y >= GRID_SIZE) {
-            return false;
+    void draw(const FrameSnapshot& frame) {
+        // Draw grid
+        std::fill(pixels.begin(), pixels.end(), FRAME_GRID);
+        for (int x = 0; x < GRID_SIZE; x++) {
+            for (int y = 0; y < GRID_SIZE; y++) {
+                fillRect(x * cellSize + 1, y * cellSize + 1, cellSize - 2, cellSize - 2, FRAME_CELL);
+            }
         }
 
-        // No longer checking for collision with snakes
-        return true;
-    }
-
-    // Calculate Manhattan distance between two positions
-    float manhattanDistance(const Position& a, const Position& b) {
-        return std::abs(a.x - b.x) + std::abs(a.y - b.y);
-    }
-
-    // A* pathfinding algorithm
-    std::vector<Position> findPathAStar(Snake& snake, const Position& goal, Snake& otherSnake) {
-        auto startTime = std::chrono::high_resolution_clock::now();
-
-        Position start = snake.getHead();
-        std::priority_queue<Node, std::vector<Node>, std::greater<Node>> openSet;
-        std::unordered_map<Position, float> gScore;
-        std::unordered_map<Position, Position> cameFrom;
-        std::unordered_set<Position> closedSet;
-
-        openSet.push(Node(start, 0, manhattanDistance(start, goal)));
-        gScore[start] = 0;
+        for (const auto& pos : frame.path1) fillCell(pos, FRAME_PATH1);
+        for (const auto& pos : frame.path2) fillCell(pos, FRAME_PATH2);
 
-        int nodesExplored = 0;
+        // Same placement as the window's food circle
+        fillCircle(frame.food.x * cellSize + cellSize * 3 / 4, frame.food.y * cellSize + cellSize * 3 / 4,
+            cellSize / 2, FRAME_FOOD);
 
-        while (!openSet.empty()) {
-            Node current = openSet.top();
-            openSet.pop();
-            nodesExplored++;
+        for (const auto& segment : frame.snake1) fillCell(segment, FRAME_SNAKE1);
+        for (const auto& segment : frame.snake2) fillCell(segment, FRAME_SNAKE2);
+    }
 
-            if (current.pos == goal) {
-                // Reconstruct path
-                std::vector<Position> path;
-                Position currentPos = goal;
+private:
+    std::vector<unsigned char> pixels;
+
+    void fillRect(int left, int top, int w, int h, unsigned char color) {
+        int right = std::min(left + w, width);
+        int bottom = std::min(top + h, height);
+        left = std::max(left, 0);
+        top = std::max(top, 0);
+        for (int y = top; y < bottom; y++) {
+            std::fill(pixels.begin() + y * width + left, pixels.begin() + y * width + right, color);
+        }
+    }
 
-                while (currentPos != start) {
-                    path.push_back(currentPos);
-                    currentPos = cameFrom[currentPos];
-                }
+    void fillCell(const Position& pos, unsigned char color) {
+        fillRect(pos.x * cellSize, pos.y * cellSize, cellSize, cellSize, color);
+    }
 
-                std::reverse(path.begin(), path.end());
+    void fillCircle(int centerX, int centerY, int radius, unsigned char color) {
+        for (int dy = -radius; dy < radius; dy++) {
+            // Sample at pixel centers
+            float y = dy + 0.5f;
+            int halfWidth = static_cast<int>(std::sqrt(radius * radius - y * y) + 0.5f);
+            fillRect(centerX - halfWidth, centerY + dy, halfWidth * 2, 1, color);
+        }
+    }
+};
 
-                auto endTime = std::chrono::high_resolution_clock::now();
-                std::chrono::duration<float> duration = endTime - startTime;
-                snake.computationTime = duration.count() * 1000; // Convert to milliseconds
-                snake.nodesExplored = nodesExplored;
+// Minimal PNG encoder for palette images. Pixel data goes into stored (uncompressed)
+// deflate blocks, which needs no zlib and costs little more than a memcpy.
+class PngWriter {
+public:
+    // Returns false if the file could not be written
+    bool write(const std::string& filename, const unsigned char* pixels, int width, int height) {
+        out.clear();
+        static const unsigned char signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        out.insert(out.end(), signature, signature + sizeof(signature));
+
+        // Header: bit depth 8, color type 3 (palette), default compression/filter/interlace
+        beginChunk("IHDR");
+        put32(width);
+        put32(height);
+        out.push_back(8);
+        out.push_back(3);
+        out.push_back(0);
+        out.push_back(0);
+        out.push_back(0);
+        endChunk();
+
+        beginChunk("PLTE");
+        for (const auto& color : FRAME_PALETTE) {
+            out.insert(out.end(), color, color + 3);
+        }
+        endChunk();
 
-                return path;
-            }
+        // Each row is prefixed with filter type 0 (none)
+        raw.clear();
+        for (int y = 0; y < height; y++) {
+            raw.push_back(0);
+            raw.insert(raw.end(), pixels + y * width, pixels + (y + 1) * width);
+        }
 
-            closedSet.insert(current.pos);
+        beginChunk("IDAT");
+        out.push_back(0x78);  // zlib header: deflate, 32K window, no dictionary
+        out.push_back(0x01);
+        size_t offset = 0;
+        bool last;
+        do {
+            size_t length = std::min<size_t>(raw.size() - offset, 65535);
+            last = offset + length == raw.size();
+            out.push_back(last ? 1 : 0);  // BFINAL, BTYPE 00 (stored)
+            out.push_back(length & 0xFF);
+            out.push_back(length >> 8);
+            out.push_back(~length & 0xFF);
+            out.push_back((~length >> 8) & 0xFF);
+            out.insert(out.end(), raw.begin() + offset, raw.begin() + offset + length);
+            offset += length;
+        } while (!last);
+        put32(adler32(raw.data(), raw.size()));
+        endChunk();
+
+        beginChunk("IEND");
+        endChunk();
+
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(out.data()), out.size());
+        return static_cast<bool>(file);
+    }
 
-            for (const auto& neighbor : getNeighbors(current.pos)) {
-                if (closedSet.find(neighbor) != closedSet.end()) {
-                    continue;
-                }
+private:
+    std::vector<unsigned char> out;  // Encoded file, reused between frames
+    std::vector<unsigned char> raw;  // Filtered scanlines
+    size_t chunkStart;
+
+    void put32(uint32_t value) {
+        out.push_back(value >> 24);
+        out.push_back((value >> 16) & 0xFF);
+        out.push_back((value >> 8) & 0xFF);
+        out.push_back(value & 0xFF);
+    }
 
-                if (!isValid(neighbor, snake, otherSnake)) {
-                    continue;
-                }
+    void beginChunk(const char* type) {
+        put32(0);  // Length, patched in endChunk
+        chunkStart = out.size();
+        out.insert(out.end(), type, type + 4);
+    }
 
-                float tentative_gScore = gScore[current.pos] + 1;
+    void endChunk() {
+        uint32_t length = static_cast<uint32_t>(out.size() - chunkStart - 4);
+        for (int i = 0; i < 4; i++) {
+            out[chunkStart - 4 + i] = (length >> (24 - 8 * i)) & 0xFF;
+        }
+        put32(crc32(out.data() + chunkStart, out.size() - chunkStart));
+    }
 
-                if (gScore.find(neighbor) == gScore.end() || tentative_gScore < gScore[neighbor]) {
-                    cameFrom[neighbor] = current.pos;
-                    gScore[neighbor] = tentative_gScore;
-                    float hScore = manhattanDistance(neighbor, goal);
-                    openSet.push(Node(neighbor, tentative_gScore, hScore));
+    static uint32_t crc32(const unsigned char* data, size_t length) {
+        static const std::vector<uint32_t> table = [] {
+            std::vector<uint32_t> entries(256);
+            for (uint32_t n = 0; n < 256; n++) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; k++) {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
                 }
+                entries[n] = c;
             }
+            return entries;
+        }();
+
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < length; i++) {
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
         }
+        return crc ^ 0xFFFFFFFFu;
+    }
 
-        auto endTime = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<float> duration = endTime - startTime;
-        snake.computationTime = duration.count() * 1000; // Convert to milliseconds
-        snake.nodesExplored = nodesExplored;
+    static uint32_t adler32(const unsigned char* data, size_t length) {
+        uint32_t a = 1, b = 0;
+        for (size_t i = 0; i < length; i++) {
+            a = (a + data[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        return (b << 16) | a;
+    }
+};
 
-        // No path found
-        return {};
+// Render frames to frame_NNNNN.png files in directory, spread over all hardware
+// threads. Frames are independent, so each worker just claims the next index.
+// Returns the number of frames written.
+int exportFrames(const std::vector<FrameSnapshot>& frames, const std::string& directory) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cerr << "Failed to create " << directory << ": " << error.message() << std::endl;
+        return 0;
     }
 
-    // Dijkstra's algorithm
-    std::vector<Position> findPathDijkstra(Snake& snake, const Position& goal, Snake& otherSnake) {
-        auto startTime = std::chrono::high_resolution_clock::now();
+    std::atomic<size_t> nextFrame(0);
+    std::atomic<int> written(0);
 
-        Position start = snake.getHead();
-        std::priority_queue<Node, std::vector<Node>, std::greater<Node>> openSet;
-        std::unordered_map<Position, float> gScore;
-        std::unordered_map<Position, Position> cameFrom;
-        std::unordered_set<Position> closedSet;
+    auto worker = [&]() {
+        FrameRasterizer rasterizer(EXPORT_CELL_SIZE);
+        PngWriter writer;
+        char name[32];
 
-        openSet.push(Node(start, 0, 0)); // No heuristic for Dijkstra
-        gScore[start] = 0;
+        for (size_t i = nextFrame++; i < frames.size(); i = nextFrame++) {
+            rasterizer.draw(frames[i]);
+            std::snprintf(name, sizeof(name), "/frame_%05zu.png", i);
+            if (writer.write(directory + name, rasterizer.data(), rasterizer.width, rasterizer.height)) {
+                written++;
+            }
+            else {
+                std::cerr << "Failed to write " << directory << name << std::endl;
+            }
+        }
+    };
 
-        int nodesExplored = 0;
+    unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < threadCount; i++) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
 
-        while (!openSet.empty()) {
-            Node current = openSet.top();
-            openSet.pop();
-            nodesExplored++;
+    return written;
+}
 
-            if (current.pos == goal) {
-                // Reconstruct path
-                std::vector<Position> path;
-                Position currentPos = goal;
+// Game class
+class Game {
+private:
+    std::unique_ptr<sf::RenderWindow> window;  // Null for headless runs
+    std::unique_ptr<PathPlanner> planner1;
+    std::unique_ptr<PathPlanner> planner2;
+    Snake snake1;
+    Snake snake2;
+    Position food;
+    sf::Font font;
+    HudText scoreText;
+    HudText statsText;
+    HudText turnText;
+    HudText avgMetricsText;
+    sf::Text gameOverText;
+    sf::Text finalStatsText;
+    sf::RectangleShape gridCell;   // Shapes reused every frame so drawing does not allocate
+    sf::RectangleShape cellShape;
+    sf::CircleShape foodShape;
+    sf::Clock gameClock;
+    float elapsedTime;
+    bool gameOver;
+    bool hudDirty;  // Set whenever a value shown on the HUD may have changed
+    bool snake1ReachedFood;
+    bool snake2ReachedFood;
+    bool snake1Planned;
+    bool snake2Planned;
+    std::mt19937 rng;
+    int currentTurn;
 
-                while (currentPos != start) {
-                    path.push_back(currentPos);
-                    currentPos = cameFrom[currentPos];
-                }
+    // Per-turn arena holding the snakes' paths and generateRandomPosition()'s candidate
+    // list, released when a new turn starts; overflow falls back to the heap.
+    std::vector<char> arenaBuffer;
+    std::pmr::monotonic_buffer_resource turnArena;
+    size_t setupHeapAllocations;  // Heap allocations made while starting turns
+    std::pmr::vector<Position> path1;
+    std::pmr::vector<Position> path2;
 
-                std::reverse(path.begin(), path.end());
+    // Run a snake's planner from its head to goal, recording nodes explored and time taken
+    void planPath(Snake& snake, PathPlanner& planner, const Position& goal, std::pmr::vector<Position>& path) {
+        auto startTime = std::chrono::high_resolution_clock::now();
 
-                auto endTime = std::chrono::high_resolution_clock::now();
-                std::chrono::duration<float> duration = endTime - startTime;
-                snake.computationTime = duration.count() * 1000; // Convert to milliseconds
-                snake.nodesExplored = nodesExplored;
+        snake.nodesExplored = planner.findPath(snake.getHead(), goal, path);
 
-                return path;
-            }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<float> duration = endTime - startTime;
+        snake.computationTime = duration.count() * 1000; // Convert to milliseconds
+        snake.suboptimality = planner.suboptimality();
+    }
 
-            closedSet.insert(current.pos);
+    // Let an anytime planner keep refining a snake's path, adding to this turn's metrics
+    void refinePath(Snake& snake, PathPlanner& planner, std::pmr::vector<Position>& path) {
+        auto startTime = std::chrono::high_resolution_clock::now();
 
-            for (const auto& neighbor : getNeighbors(current.pos)) {
-                if (closedSet.find(neighbor) != closedSet.end()) {
-                    continue;
-                }
+        int nodesExplored = 0;
+        planner.improvePath(snake.getHead(), path, nodesExplored);
 
-                if (!isValid(neighbor, snake, otherSnake)) {
-                    continue;
-                }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<float> duration = endTime - startTime;
+        snake.nodesExplored += nodesExplored;
+        snake.computationTime += duration.count() * 1000; // Convert to milliseconds
+        snake.suboptimality = planner.suboptimality();
+    }
 
-                float tentative_gScore = gScore[current.pos] + 1;
+    // Plan once per turn, or keep planning while no path has been found yet; anytime
+    // planners then refine their path on every later tick until it is optimal
+    void updatePath(Snake& snake, PathPlanner& planner, std::pmr::vector<Position>& path, bool& planned) {
+        if (!planned) {
+            planPath(snake, planner, food, path);
+            planned = !path.empty() || planner.improving();
+            hudDirty = true;
+        }
+        else if (planner.improving()) {
+            refinePath(snake, planner, path);
+            hudDirty = true;
 
-                if (gScore.find(neighbor) == gScore.end() || tentative_gScore < gScore[neighbor]) {
-                    cameFrom[neighbor] = current.pos;
-                    gScore[neighbor] = tentative_gScore;
-                    openSet.push(Node(neighbor, tentative_gScore, 0)); // h_cost is 0 for Dijkstra
-                }
+            // The search ended without ever publishing a path; start over next tick
+            if (path.empty() && !planner.improving()) {
+                planned = false;
             }
         }
-
-        auto endTime = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<float> duration = endTime - startTime;
-        snake.computationTime = duration.count() * 1000; // Convert to milliseconds
-        snake.nodesExplored = nodesExplored;
-
-        // No path found
-        return {};
     }
 
     // Get next position based on direction
@@ -369,7 +1484,8 @@ private:
 
     // Generate a random position that is not occupied by either snake
     Position generateRandomPosition() {
-        std::vector<Position> candidates;
+        std::pmr::vector<Position> candidates(&turnArena);
+        candidates.reserve(GRID_SIZE * GRID_SIZE);
         Position head1 = snake1.getHead();
         Position head2 = snake2.getHead();
 
@@ -445,14 +1561,29 @@ private:
 
     // Start a new turn
     void startNewTurn() {
+        // Drop the previous turn's paths, then hand the whole arena back at once
+        std::pmr::vector<Position>(&turnArena).swap(path1);
+        std::pmr::vector<Position>(&turnArena).swap(path2);
+        turnArena.release();
+        size_t allocationsBefore = heapAllocationCount.load(std::memory_order_relaxed);
+
+        snake1ReachedFood = false;
+        snake2ReachedFood = false;
+        snake1Planned = false;
+        snake2Planned = false;
+        snake1.beginTurn();
+        snake2.beginTurn();
+
         // Generate new food position
         food = generateRandomPosition();
 
         // Increment turn counter
         currentTurn++;
 
+        setupHeapAllocations += heapAllocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+
         // Display turn information
-        updateText();
+        hudDirty = true;
     }
 
     // Check if both snakes have reached the food
@@ -460,54 +1591,163 @@ private:
         return (snake1.body.front() == food && snake2.body.front() == food);
     }
 
-    // Format floating point number as string with specified precision
-    std::string formatFloat(float value, int precision = 2) {
-        std::stringstream ss;
-        ss << std::fixed << std::setprecision(precision) << value;
-        return ss.str();
-    }
-
-    // Update text display
+    // Update text display; does nothing unless a displayed value has changed
     void updateText() {
-        scoreText.setString("A* (Red): " + std::to_string(snake1.score) +
-            " | Dijkstra (Blue): " + std::to_string(snake2.score));
-
-        statsText.setString(
-            "A*: " + std::to_string(snake1.nodesExplored) + " nodes, " +
-            formatFloat(snake1.computationTime) + " ms\n" +
-            "Dijkstra: " + std::to_string(snake2.nodesExplored) + " nodes, " +
-            formatFloat(snake2.computationTime) + " ms"
-        );
+        if (!window || !hudDirty) return;
+        hudDirty = false;
 
-        turnText.setString("Turn: " + std::to_string(currentTurn) + "/" + std::to_string(TOTAL_TURNS));
+        if (gameOver) {
+            updateGameOverText();
+        }
+
+        TextBuffer text;
+
+        text.append(snake1.algorithm.c_str());
+        text.append(" (Red): ");
+        text.appendInt(snake1.score);
+        text.append(" | ");
+        text.append(snake2.algorithm.c_str());
+        text.append(" (Blue): ");
+        text.appendInt(snake2.score);
+        scoreText.update(text);
+
+        text.clear();
+        text.append(snake1.algorithm.c_str());
+        text.append(": ");
+        text.appendInt(snake1.nodesExplored);
+        text.append(" nodes, ");
+        text.appendFloat(snake1.computationTime);
+        text.append(" ms, bound ");
+        text.appendFloat(snake1.suboptimality);
+        text.append("\n");
+        text.append(snake2.algorithm.c_str());
+        text.append(": ");
+        text.appendInt(snake2.nodesExplored);
+        text.append(" nodes, ");
+        text.appendFloat(snake2.computationTime);
+        text.append(" ms, bound ");
+        text.appendFloat(snake2.suboptimality);
+        statsText.update(text);
+
+        text.clear();
+        text.append("Turn: ");
+        text.appendInt(currentTurn);
+        text.append("/");
+        text.appendInt(TOTAL_TURNS);
+        turnText.update(text);
 
         // Update average metrics text
         TurnMetrics avg1 = snake1.getAverageMetrics();
         TurnMetrics avg2 = snake2.getAverageMetrics();
 
-        avgMetricsText.setString(
-            "Avg A*: " + std::to_string(avg1.nodesExplored) + " nodes, " +
-            formatFloat(avg1.computationTime) + " ms\n" +
-            "Avg Dijkstra: " + std::to_string(avg2.nodesExplored) + " nodes, " +
-            formatFloat(avg2.computationTime) + " ms"
-        );
+        text.clear();
+        text.append("Avg ");
+        text.append(snake1.algorithm.c_str());
+        text.append(": ");
+        text.appendInt(avg1.nodesExplored);
+        text.append(" nodes, ");
+        text.appendFloat(avg1.computationTime);
+        text.append(" ms, subopt ");
+        text.appendFloat(avg1.suboptimality);
+        text.append("\nAvg ");
+        text.append(snake2.algorithm.c_str());
+        text.append(": ");
+        text.appendInt(avg2.nodesExplored);
+        text.append(" nodes, ");
+        text.appendFloat(avg2.computationTime);
+        text.append(" ms, subopt ");
+        text.appendFloat(avg2.suboptimality);
+        avgMetricsText.update(text);
+    }
+
+    // Build the game over texts, once when the competition ends
+    void updateGameOverText() {
+        // Determine winner based on score
+        TextBuffer text;
+        text.append("Game Complete!\n");
+        if (snake1.score > snake2.score) {
+            text.append(snake1.algorithm.c_str());
+            text.append(" wins!");
+        }
+        else if (snake2.score > snake1.score) {
+            text.append(snake2.algorithm.c_str());
+            text.append(" wins!");
+        }
+        else {
+            text.append("It's a tie!");
+        }
+        text.append("\nPress R to restart");
+        gameOverText.setString(text.data);
+
+        // Center the text
+        sf::FloatRect textRect = gameOverText.getLocalBounds();
+        gameOverText.setOrigin(textRect.left + textRect.width / 2.0f,
+            textRect.top + textRect.height / 2.0f);
+        gameOverText.setPosition(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f);
+
+        // Final statistics
+        TurnMetrics avg1 = snake1.getAverageMetrics();
+        TurnMetrics avg2 = snake2.getAverageMetrics();
+
+        text.clear();
+        text.append("Final Stats:\n");
+        text.append(snake1.algorithm.c_str());
+        text.append(": Score=");
+        text.appendInt(snake1.score);
+        text.append(", Avg Nodes=");
+        text.appendInt(avg1.nodesExplored);
+        text.append(", Avg Time=");
+        text.appendFloat(avg1.computationTime);
+        text.append("ms, Avg Subopt=");
+        text.appendFloat(avg1.suboptimality);
+        text.append(", Heap Allocs=");
+        text.appendInt(snake1.totalHeapAllocations);
+        text.append("\n");
+        text.append(snake2.algorithm.c_str());
+        text.append(": Score=");
+        text.appendInt(snake2.score);
+        text.append(", Avg Nodes=");
+        text.appendInt(avg2.nodesExplored);
+        text.append(", Avg Time=");
+        text.appendFloat(avg2.computationTime);
+        text.append("ms, Avg Subopt=");
+        text.appendFloat(avg2.suboptimality);
+        text.append(", Heap Allocs=");
+        text.appendInt(snake2.totalHeapAllocations);
+        finalStatsText.setString(text.data);
     }
 
 public:
-    Game() :
-        window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT + 150), "Snake AI Competition"),
-        snake1(Position(5, 10), RIGHT, sf::Color::Red, "A*"),
-        snake2(Position(15, 10), LEFT, sf::Color::Blue, "Dijkstra"),
+    Game(std::unique_ptr<PathPlanner> first, std::unique_ptr<PathPlanner> second, bool headless = false) :
+        window(headless ? nullptr :
+            new sf::RenderWindow(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT + 150), "Snake AI Competition")),
+        planner1(std::move(first)),
+        planner2(std::move(second)),
+        snake1(Position(5, 10), RIGHT, sf::Color::Red, planner1->label()),
+        snake2(Position(15, 10), LEFT, sf::Color::Blue, planner2->label()),
         elapsedTime(0),
         gameOver(false),
+        hudDirty(true),
+        snake1ReachedFood(false),
+        snake2ReachedFood(false),
+        snake1Planned(false),
+        snake2Planned(false),
         rng(std::random_device{}()),
-        currentTurn(0)
+        currentTurn(0),
+        arenaBuffer(TURN_ARENA_SIZE),
+        turnArena(arenaBuffer.data(), arenaBuffer.size()),
+        setupHeapAllocations(0),
+        path1(&turnArena),
+        path2(&turnArena)
     {
-        window.setFramerateLimit(60);
-
         // Initialize first turn
         startNewTurn();
 
+        // Headless runs have no HUD
+        if (!window) return;
+
+        window->setFramerateLimit(60);
+
         // Load font
         if (!font.loadFromFile("arial.ttf")) {
             std::cerr << "Failed to load font!" << std::endl;
@@ -515,51 +1755,154 @@ public:
         }
 
         // Set up text
-        scoreText.setFont(font);
-        scoreText.setCharacterSize(20);
-        scoreText.setFillColor(sf::Color::White);
-        scoreText.setPosition(10, WINDOW_HEIGHT + 10);
+        scoreText.text.setFont(font);
+        scoreText.text.setCharacterSize(20);
+        scoreText.text.setFillColor(sf::Color::White);
+        scoreText.text.setPosition(10, WINDOW_HEIGHT + 10);
+
+        statsText.text.setFont(font);
+        statsText.text.setCharacterSize(14);
+        statsText.text.setFillColor(sf::Color::White);
+        statsText.text.setPosition(10, WINDOW_HEIGHT + 50);
+
+        turnText.text.setFont(font);
+        turnText.text.setCharacterSize(16);
+        turnText.text.setFillColor(sf::Color::Yellow);
+        turnText.text.setPosition(10, WINDOW_HEIGHT + 90);
+
+        avgMetricsText.text.setFont(font);
+        avgMetricsText.text.setCharacterSize(14);
+        avgMetricsText.text.setFillColor(sf::Color::Green);
+        avgMetricsText.text.setPosition(10, WINDOW_HEIGHT + 120);
+
+        gameOverText.setFont(font);
+        gameOverText.setCharacterSize(40);
+        gameOverText.setFillColor(sf::Color::White);
+
+        finalStatsText.setFont(font);
+        finalStatsText.setCharacterSize(18);
+        finalStatsText.setFillColor(sf::Color::Yellow);
+        finalStatsText.setPosition(20, 100);
+
+        gridCell.setSize(sf::Vector2f(CELL_SIZE, CELL_SIZE));
+        gridCell.setOutlineThickness(1);
+        gridCell.setOutlineColor(sf::Color(70, 70, 70));
+        gridCell.setFillColor(sf::Color(30, 30, 30));
+
+        cellShape.setSize(sf::Vector2f(CELL_SIZE, CELL_SIZE));
+
+        foodShape.setRadius(CELL_SIZE / 2);
+        foodShape.setFillColor(sf::Color::Green);
+    }
+
+    // Plan for and move one snake by a cell. Heap allocations made on the way are
+    // charged to the snake's turn, so the metrics show what the simulation allocates.
+    void advanceSnake(Snake& snake, PathPlanner& planner, std::pmr::vector<Position>& path,
+        bool& reachedFood, bool& planned) {
+        if (reachedFood) return;
+        size_t allocationsBefore = heapAllocationCount.load(std::memory_order_relaxed);
+
+        // Find or refine the path if needed
+        updatePath(snake, planner, path, planned);
+
+        // Move the snake along its path
+        bool ateFood = false;
+        if (!path.empty()) {
+            Position nextPos = path[0];
+            path.erase(path.begin());
+            snake.direction = calculateDirection(snake.getHead(), nextPos);
+
+            // Check if snake reached food
+            ateFood = nextPos == food;
+            if (ateFood) {
+                snake.grow(nextPos);
+            }
+            else {
+                snake.move(nextPos);
+            }
+        }
 
-        statsText.setFont(font);
-        statsText.setCharacterSize(14);
-        statsText.setFillColor(sf::Color::White);
-        statsText.setPosition(10, WINDOW_HEIGHT + 50);
+        snake.heapAllocations += heapAllocationCount.load(std::memory_order_relaxed) - allocationsBefore;
 
-        turnText.setFont(font);
-        turnText.setCharacterSize(16);
-        turnText.setFillColor(sf::Color::Yellow);
-        turnText.setPosition(10, WINDOW_HEIGHT + 90);
+        if (ateFood) {
+            reachedFood = true;
+            snake.recordTurnMetrics(); // Record metrics for this turn
+            hudDirty = true;
+        }
+    }
 
-        avgMetricsText.setFont(font);
-        avgMetricsText.setCharacterSize(14);
-        avgMetricsText.setFillColor(sf::Color::Green);
-        avgMetricsText.setPosition(10, WINDOW_HEIGHT + 120);
+    // Advance the game by one move of each snake. Only simulates; the window's
+    // HUD is refreshed separately by updateText().
+    void step() {
+        advanceSnake(snake1, *planner1, path1, snake1ReachedFood, snake1Planned);
+        advanceSnake(snake2, *planner2, path2, snake2ReachedFood, snake2Planned);
+
+        // If both snakes have reached food, start a new turn
+        if (snake1ReachedFood && snake2ReachedFood) {
+            // Check if we've completed all turns
+            if (currentTurn >= TOTAL_TURNS) {
+                gameOver = true;
+                hudDirty = true;
+            }
+            else {
+                startNewTurn();
+            }
+        }
     }
 
-    void run() {
-        std::vector<Position> path1, path2;
-        bool snake1ReachedFood = false;
-        bool snake2ReachedFood = false;
+    // Per-turn metrics for both snakes, for headless runs
+    void printSummary(std::ostream& out) const {
+        for (const Snake* snake : { &snake1, &snake2 }) {
+            TurnMetrics avg = snake->getAverageMetrics();
+            out << snake->algorithm << ": score " << snake->score
+                << ", avg " << avg.nodesExplored << " nodes, "
+                << avg.computationTime << " ms, subopt " << avg.suboptimality
+                << "\n  heap allocations per turn:";
+            for (const auto& metrics : snake->turnMetrics) {
+                out << " " << metrics.heapAllocations;
+            }
+            out << " (total " << snake->totalHeapAllocations << ")\n";
+        }
+        out << "Turn setup heap allocations: " << setupHeapAllocations << "\n";
+    }
+
+    FrameSnapshot snapshot() const {
+        FrameSnapshot frame;
+        frame.snake1 = snake1.body;
+        frame.snake2 = snake2.body;
+        frame.path1.assign(path1.begin(), path1.end());
+        frame.path2.assign(path2.begin(), path2.end());
+        frame.food = food;
+        return frame;
+    }
 
-        while (window.isOpen()) {
+    // Play the whole competition as fast as possible, capturing every tick
+    void record(std::vector<FrameSnapshot>& frames) {
+        frames.push_back(snapshot());
+        for (int tick = 0; !gameOver && tick < MAX_HEADLESS_TICKS; tick++) {
+            step();
+            frames.push_back(snapshot());
+        }
+    }
+
+    void run() {
+        while (window->isOpen()) {
             sf::Event event;
-            while (window.pollEvent(event)) {
+            while (window->pollEvent(event)) {
                 if (event.type == sf::Event::Closed) {
-                    window.close();
+                    window->close();
                 }
                 else if (event.type == sf::Event::KeyPressed) {
                     if (event.key.code == sf::Keyboard::R) {
                         // Reset game
-                        snake1 = Snake(Position(5, 10), RIGHT, sf::Color::Red, "A*");
-                        snake2 = Snake(Position(15, 10), LEFT, sf::Color::Blue, "Dijkstra");
+                        snake1 = Snake(Position(5, 10), RIGHT, sf::Color::Red, planner1->label());
+                        snake2 = Snake(Position(15, 10), LEFT, sf::Color::Blue, planner2->label());
                         currentTurn = 0;
                         startNewTurn();
                         gameOver = false;
-                        snake1ReachedFood = false;
-                        snake2ReachedFood = false;
                     }
                     else if (event.key.code == sf::Keyboard::Escape) {
-                        window.close();
+                        window->close();
                     }
                 }
             }
@@ -571,188 +1914,134 @@ public:
 
                 if (elapsedTime >= GAME_SPEED) {
                     elapsedTime = 0;
-
-                    // Find paths for both snakes if needed
-                    if (path1.empty() && !snake1ReachedFood) {
-                        path1 = findPathAStar(snake1, food, snake2);
-                    }
-
-                    if (path2.empty() && !snake2ReachedFood) {
-                        path2 = findPathDijkstra(snake2, food, snake1);
-                    }
-
-                    // Move snake1 along its path if not already at food
-                    if (!path1.empty() && !snake1ReachedFood) {
-                        Position nextPos = path1[0];
-                        path1.erase(path1.begin());
-                        snake1.direction = calculateDirection(snake1.getHead(), nextPos);
-
-                        // Check if snake reached food
-                        if (nextPos == food) {
-                            snake1.grow(nextPos);
-                            snake1ReachedFood = true;
-                            snake1.recordTurnMetrics(); // Record metrics for this turn
-                        }
-                        else {
-                            snake1.move(nextPos);
-                        }
-                    }
-
-                    // Move snake2 along its path if not already at food
-                    if (!path2.empty() && !snake2ReachedFood) {
-                        Position nextPos = path2[0];
-                        path2.erase(path2.begin());
-                        snake2.direction = calculateDirection(snake2.getHead(), nextPos);
-
-                        // Check if snake reached food
-                        if (nextPos == food) {
-                            snake2.grow(nextPos);
-                            snake2ReachedFood = true;
-                            snake2.recordTurnMetrics(); // Record metrics for this turn
-                        }
-                        else {
-                            snake2.move(nextPos);
-                        }
-                    }
-
-                    // If both snakes have reached food, start a new turn
-                    if (snake1ReachedFood && snake2ReachedFood) {
-                        // Check if we've completed all turns
-                        if (currentTurn >= TOTAL_TURNS) {
-                            gameOver = true;
-                        }
-                        else {
-                            startNewTurn();
-                            path1.clear();
-                            path2.clear();
-                            snake1ReachedFood = false;
-                            snake2ReachedFood = false;
-                        }
-                    }
-
-                    updateText();
+                    step();
                 }
             }
 
+            updateText();
+
             // Draw everything
-            window.clear(sf::Color(50, 50, 50));
+            window->clear(sf::Color(50, 50, 50));
 
             // Draw grid
             for (int x = 0; x < GRID_SIZE; x++) {
                 for (int y = 0; y < GRID_SIZE; y++) {
-                    sf::RectangleShape cell(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                    cell.setPosition(x * CELL_SIZE, y * CELL_SIZE);
-                    cell.setOutlineThickness(1);
-                    cell.setOutlineColor(sf::Color(70, 70, 70));
-                    cell.setFillColor(sf::Color(30, 30, 30));
-                    window.draw(cell);
+                    gridCell.setPosition(x * CELL_SIZE, y * CELL_SIZE);
+                    window->draw(gridCell);
                 }
             }
 
             // Draw paths (if debug mode)
             sf::Color path1Color(255, 100, 100, 80);
             for (const auto& pos : path1) {
-                sf::RectangleShape cell(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                cell.setPosition(pos.x * CELL_SIZE, pos.y * CELL_SIZE);
-                cell.setFillColor(path1Color);
-                window.draw(cell);
+                cellShape.setPosition(pos.x * CELL_SIZE, pos.y * CELL_SIZE);
+                cellShape.setFillColor(path1Color);
+                window->draw(cellShape);
             }
 
             sf::Color path2Color(100, 100, 255, 80);
             for (const auto& pos : path2) {
-                sf::RectangleShape cell(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                cell.setPosition(pos.x * CELL_SIZE, pos.y * CELL_SIZE);
-                cell.setFillColor(path2Color);
-                window.draw(cell);
+                cellShape.setPosition(pos.x * CELL_SIZE, pos.y * CELL_SIZE);
+                cellShape.setFillColor(path2Color);
+                window->draw(cellShape);
             }
 
             // Draw food
-            sf::CircleShape foodShape(CELL_SIZE / 2);
             foodShape.setPosition(food.x * CELL_SIZE + CELL_SIZE / 4, food.y * CELL_SIZE + CELL_SIZE / 4);
-            foodShape.setFillColor(sf::Color::Green);
-            window.draw(foodShape);
+            window->draw(foodShape);
 
             // Draw snake1
             for (const auto& segment : snake1.body) {
-                sf::RectangleShape cell(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                cell.setPosition(segment.x * CELL_SIZE, segment.y * CELL_SIZE);
-                cell.setFillColor(snake1.color);
-                window.draw(cell);
+                cellShape.setPosition(segment.x * CELL_SIZE, segment.y * CELL_SIZE);
+                cellShape.setFillColor(snake1.color);
+                window->draw(cellShape);
             }
 
             // Draw snake2
             for (const auto& segment : snake2.body) {
-                sf::RectangleShape cell(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                cell.setPosition(segment.x * CELL_SIZE, segment.y * CELL_SIZE);
-                cell.setFillColor(snake2.color);
-                window.draw(cell);
+                cellShape.setPosition(segment.x * CELL_SIZE, segment.y * CELL_SIZE);
+                cellShape.setFillColor(snake2.color);
+                window->draw(cellShape);
             }
 
             // Draw text
-            window.draw(scoreText);
-            window.draw(statsText);
-            window.draw(turnText);
-            window.draw(avgMetricsText);
+            window->draw(scoreText.text);
+            window->draw(statsText.text);
+            window->draw(turnText.text);
+            window->draw(avgMetricsText.text);
 
             // Draw game over text if applicable
             if (gameOver) {
-                sf::Text gameOverText;
-                gameOverText.setFont(font);
-                gameOverText.setCharacterSize(40);
-                gameOverText.setFillColor(sf::Color::White);
-
-                // Determine winner based on score
-                std::string resultText;
-                if (snake1.score > snake2.score) {
-                    resultText = "A* wins!";
-                }
-                else if (snake2.score > snake1.score) {
-                    resultText = "Dijkstra wins!";
-                }
-                else {
-                    resultText = "It's a tie!";
-                }
+                window->draw(gameOverText);
+                window->draw(finalStatsText);
+            }
 
-                gameOverText.setString("Game Complete!\n" + resultText + "\nPress R to restart");
+            window->display();
+        }
+    }
+};
 
-                // Center the text
-                sf::FloatRect textRect = gameOverText.getLocalBounds();
-                gameOverText.setOrigin(textRect.left + textRect.width / 2.0f,
-                    textRect.top + textRect.height / 2.0f);
-                gameOverText.setPosition(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f);
+int main(int argc, char* argv[]) {
+    PlannerRegistry registry;
+    registerBuiltinPlanners(registry);
 
-                window.draw(gameOverText);
+    if (argc > 1 && std::string(argv[1]) == "--list") {
+        std::cout << "Available planners:\n";
+        registry.list(std::cout);
+        return 0;
+    }
 
-                // Display final statistics
-                sf::Text finalStatsText;
-                finalStatsText.setFont(font);
-                finalStatsText.setCharacterSize(18);
-                finalStatsText.setFillColor(sf::Color::Yellow);
+    const char* usage = "Usage: path_game [planner1] [planner2] [--export DIR]\n"
+        "       path_game --list\n";
+    std::vector<std::string> names;
+    std::string exportDirectory;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--export") {
+            if (i + 1 >= argc) {
+                std::cerr << "--export needs a directory\n" << usage;
+                return 1;
+            }
+            exportDirectory = argv[++i];
+        }
+        else {
+            names.push_back(arg);
+        }
+    }
+    if (names.size() > 2) {
+        std::cerr << "Too many planners: " << names[2] << " (at most two can race)\n" << usage;
+        return 1;
+    }
+    std::string name1 = names.size() > 0 ? names[0] : "astar";
+    std::string name2 = names.size() > 1 ? names[1] : "dijkstra";
+
+    std::unique_ptr<PathPlanner> planner1 = registry.create(name1);
+    std::unique_ptr<PathPlanner> planner2 = registry.create(name2);
+    if (!planner1 || !planner2) {
+        std::cerr << "Unknown planner: " << (planner1 ? name2 : name1) << "\n"
+            << "Available planners:\n";
+        registry.list(std::cerr);
+        return 1;
+    }
 
-                TurnMetrics avg1 = snake1.getAverageMetrics();
-                TurnMetrics avg2 = snake2.getAverageMetrics();
+    // Headless run rendered straight to PNG frames, for machines without a display
+    if (!exportDirectory.empty()) {
+        auto startTime = std::chrono::high_resolution_clock::now();
 
-                finalStatsText.setString(
-                    "Final Stats:/n"
-                    "A*: Score=" + std::to_string(snake1.score) + 
-                    ", Avg Nodes=" + std::to_string(avg1.nodesExplored) +
-                    ", Avg Time=" + formatFloat(avg1.computationTime) + "ms\n" +
-                    "Dijkstra: Score=" + std::to_string(snake2.score) +
-                    ", Avg Nodes=" + std::to_string(avg2.nodesExplored) +
-                    ", Avg Time=" + formatFloat(avg2.computationTime) + "ms"
-                );
-                
-                finalStatsText.setPosition(20, 100);
-                window.draw(finalStatsText);
-            }
+        Game game(std::move(planner1), std::move(planner2), true);
+        std::vector<FrameSnapshot> frames;
+        game.record(frames);
+        int written = exportFrames(frames, exportDirectory);
 
-            window.display();
-        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<float> duration = endTime - startTime;
+        game.printSummary(std::cout);
+        std::cout << "Wrote " << written << "/" << frames.size() << " frames to " << exportDirectory
+            << " in " << duration.count() << " s" << std::endl;
+        return written == static_cast<int>(frames.size()) ? 0 : 1;
     }
-};
 
-int main() {
-    Game game;
+    Game game(std::move(planner1), std::move(planner2));
     game.run();
     return 0;
 }